@@ -73,6 +73,17 @@ typedef struct {
     unsigned char data[64];
 } secp256k1_ecdsa_signature;
 
+/** Opaque data structure that holds the state of a streaming SHA256 computation.
+ *
+ *  The exact representation of data inside is implementation defined and not
+ *  guaranteed to be portable between different platforms or versions. It is
+ *  however guaranteed to be 112 bytes in size, and can be safely copied/moved.
+ *  Copying a state allows a common prefix to be hashed only once.
+ */
+typedef struct {
+    unsigned char data[112];
+} secp256k1_hashstate;
+
 /** A pointer to a function to deterministically generate a nonce.
  *
  * Returns: 1 if a nonce was successfully generated. 0 will cause signing to fail.
@@ -154,6 +165,10 @@ typedef int (*secp256k1_nonce_function)(
 /** Flag to pass to secp256k1_ec_pubkey_serialize and secp256k1_ec_privkey_export. */
 # define SECP256K1_EC_COMPRESSED  (1 << 0)
 
+/** Flag to pass to secp256k1_hashstate_finalize, secp256k1_ecdsa_sign_hashstate
+ *  and secp256k1_ecdsa_verify_hashstate to use double-SHA256 instead of SHA256. */
+# define SECP256K1_HASHSTATE_DOUBLE (1 << 0)
+
 /** Create a secp256k1 context object.
  *
  *  Returns: a newly created context object.
@@ -250,6 +265,36 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_ec_pubkey_parse(
     size_t inputlen
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3);
 
+/** Parse a number of variable-length public keys at once.
+ *
+ *  Returns: 1 if all public keys were parsed successfully.
+ *           0 if at least one public key could not be parsed or is invalid.
+ *  Args: ctx:       a secp256k1 context object.
+ *  Out:  pubkeys:   pointer to an array of n pubkey objects. The ones that
+ *                   parsed are set as by secp256k1_ec_pubkey_parse, the others
+ *                   are zeroed.
+ *        valid:     pointer to an array of (n + 7) / 8 bytes, in which bit (i % 8)
+ *                   of byte i / 8 is set if and only if the ith key parsed.
+ *  In:   input:     pointer to the serialized public keys, stored back to back
+ *        inputlens: pointer to an array of n lengths, one for each key in input
+ *        n:         the number of public keys to parse
+ *
+ *  The accepted formats are the same as for secp256k1_ec_pubkey_parse. Only
+ *  compressed keys are batched: their square roots are computed 4 at a time.
+ *  Uncompressed and hybrid keys are checked one at a time. With the x86_64
+ *  assembly field implementation this makes parsing compressed keys about 8%
+ *  faster than calling secp256k1_ec_pubkey_parse for each; other builds see
+ *  no gain.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_ec_pubkey_parse_batch(
+    const secp256k1_context* ctx,
+    secp256k1_pubkey *pubkeys,
+    unsigned char *valid,
+    const unsigned char *input,
+    const size_t *inputlens,
+    size_t n
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4) SECP256K1_ARG_NONNULL(5);
+
 /** Serialize a pubkey object into a serialized byte sequence.
  *
  *  Returns: 1 always.
@@ -322,6 +367,71 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_ecdsa_verify(
     const secp256k1_pubkey *pubkey
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4);
 
+/** Initialize a streaming SHA256 computation.
+ *
+ *  Returns: 1 always.
+ *  Args:    ctx:       a secp256k1 context object.
+ *  Out:     hashstate: pointer to a hash state object to initialize (cannot be NULL)
+ */
+SECP256K1_API int secp256k1_hashstate_initialize(
+    const secp256k1_context* ctx,
+    secp256k1_hashstate *hashstate
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2);
+
+/** Feed data into a streaming SHA256 computation.
+ *
+ *  Returns: 1 always.
+ *  Args:    ctx:       a secp256k1 context object.
+ *  In/Out:  hashstate: pointer to an initialized hash state object (cannot be NULL)
+ *  In:      input:     pointer to the data to hash (can be NULL if inputlen is 0)
+ *           inputlen:  the number of bytes in input
+ */
+SECP256K1_API int secp256k1_hashstate_write(
+    const secp256k1_context* ctx,
+    secp256k1_hashstate *hashstate,
+    const unsigned char *input,
+    size_t inputlen
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2);
+
+/** Compute the hash of all data fed into a streaming SHA256 computation.
+ *
+ *  Returns: 1 always.
+ *  Args:    ctx:       a secp256k1 context object.
+ *  Out:     output32:  pointer to a 32-byte array to place the hash in (cannot be NULL)
+ *  In:      hashstate: pointer to an initialized hash state object (cannot be NULL)
+ *           flags:     SECP256K1_HASHSTATE_DOUBLE to compute SHA256(SHA256(data)),
+ *                      or 0 to compute SHA256(data).
+ *
+ *  The hash state is not modified, so more data can still be written to it.
+ */
+SECP256K1_API int secp256k1_hashstate_finalize(
+    const secp256k1_context* ctx,
+    unsigned char *output32,
+    const secp256k1_hashstate *hashstate,
+    unsigned int flags
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3);
+
+/** Verify an ECDSA signature of the hash of a streamed message.
+ *
+ *  Returns: 1: correct signature
+ *           0: incorrect or unparseable signature
+ *  Args:    ctx:       a secp256k1 context object, initialized for verification.
+ *  In:      sig:       the signature being verified (cannot be NULL)
+ *           hashstate: the hash state of the message being verified (cannot be NULL)
+ *           pubkey:    pointer to an initialized public key to verify with (cannot be NULL)
+ *           flags:     SECP256K1_HASHSTATE_DOUBLE or 0, as in secp256k1_hashstate_finalize.
+ *
+ *  Equivalent to secp256k1_ecdsa_verify with the output of
+ *  secp256k1_hashstate_finalize as msg32.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_ecdsa_verify_hashstate(
+    const secp256k1_context* ctx,
+    const secp256k1_ecdsa_signature *sig,
+    const secp256k1_hashstate *hashstate,
+    const secp256k1_pubkey *pubkey,
+    unsigned int flags
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4);
+
 /** An implementation of RFC6979 (using HMAC-SHA256) as nonce generation function.
  * If a data pointer is passed, it is assumed to be a pointer to 32 bytes of
  * extra entropy.
@@ -378,6 +488,31 @@ SECP256K1_API int secp256k1_ecdsa_sign(
     const void *ndata
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4);
 
+/** Create an ECDSA signature of the hash of a streamed message.
+ *
+ *  Returns: 1: signature created
+ *           0: the nonce generation function failed, or the private key was invalid.
+ *  Args:    ctx:       pointer to a context object, initialized for signing (cannot be NULL)
+ *  Out:     sig:       pointer to an array where the signature will be placed (cannot be NULL)
+ *  In:      hashstate: the hash state of the message being signed (cannot be NULL)
+ *           seckey:    pointer to a 32-byte secret key (cannot be NULL)
+ *           noncefp:   pointer to a nonce generation function. If NULL, secp256k1_nonce_function_default is used
+ *           ndata:     pointer to arbitrary data used by the nonce generation function (can be NULL)
+ *           flags:     SECP256K1_HASHSTATE_DOUBLE or 0, as in secp256k1_hashstate_finalize.
+ *
+ *  Equivalent to secp256k1_ecdsa_sign with the output of
+ *  secp256k1_hashstate_finalize as msg32.
+ */
+SECP256K1_API int secp256k1_ecdsa_sign_hashstate(
+    const secp256k1_context* ctx,
+    secp256k1_ecdsa_signature *sig,
+    const secp256k1_hashstate *hashstate,
+    const unsigned char *seckey,
+    secp256k1_nonce_function noncefp,
+    const void *ndata,
+    unsigned int flags
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4);
+
 /** Verify an ECDSA secret key.
  *
  *  Returns: 1: secret key is valid
@@ -522,6 +657,30 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_context_randomize(
     const unsigned char *seed32
 ) SECP256K1_ARG_NONNULL(1);
 
+/** Cheaply updates the context randomization.
+ *  Returns: 1: randomization successfully updated
+ *           0: error
+ *  Args:    ctx:       pointer to a context object (cannot be NULL)
+ *  In:      seed32:    pointer to a 32-byte random seed (cannot be NULL)
+ *
+ *  After secp256k1_context_randomize or a full update, the next 8 calls each
+ *  cost about as much as secp256k1_context_randomize, and the following 56 a
+ *  hash and about ten group additions. The call after those is a full update,
+ *  which costs the same as secp256k1_context_randomize, and starts over.
+ *
+ *  Each of the first 8 calls after a full update adds a new secret value to the
+ *  blinding, as secp256k1_context_randomize does. Each later call doubles the
+ *  blinding and adds a subset of these 8 secret values chosen by 8 bits of a
+ *  hash of the seed and the old blinding; the rest of the hash rerandomizes the
+ *  point representation. An attacker who learns the seeds and, through side
+ *  channels, several consecutive blinding values can recover the later ones up
+ *  to the next full update. Use secp256k1_context_randomize where that matters.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_context_rerandomize(
+    secp256k1_context* ctx,
+    const unsigned char *seed32
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2);
+
 /** Add a number of public keys together.
  *  Returns: 1: the sum of the public keys is valid.
  *           0: the sum of the public keys is not valid.
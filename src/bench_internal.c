@@ -25,6 +25,9 @@ typedef struct {
     secp256k1_gej gej_x, gej_y;
     unsigned char data[64];
     int wnaf[256];
+    secp256k1_context *ctx;
+    unsigned char pubkeys[64 * 33];
+    size_t pubkeylens[64];
 } bench_inv_t;
 
 void bench_setup(void* arg) {
@@ -191,6 +194,25 @@ void bench_field_sqrt_var(void* arg) {
     }
 }
 
+void bench_field_sqrt_4_var(void* arg) {
+    int i, j;
+    bench_inv_t *data = (bench_inv_t*)arg;
+    secp256k1_fe a[4], r[4];
+
+    for (j = 0; j < 4; j++) {
+        a[j] = data->fe_x;
+        secp256k1_fe_add(&data->fe_x, &data->fe_y);
+    }
+    for (i = 0; i < 5000; i++) {
+        secp256k1_fe_sqrt_4_var(r, a);
+        for (j = 0; j < 4; j++) {
+            secp256k1_fe_add(&r[j], &data->fe_y);
+            a[j] = r[j];
+        }
+    }
+    data->fe_x = a[0];
+}
+
 void bench_group_double_var(void* arg) {
     int i;
     bench_inv_t *data = (bench_inv_t*)arg;
@@ -283,6 +305,103 @@ void bench_rfc6979_hmac_sha256(void* arg) {
     }
 }
 
+void bench_pubkey_setup(void* arg) {
+    int i, j;
+    bench_inv_t *data = (bench_inv_t*)arg;
+    unsigned char seckey[32];
+
+    data->ctx = secp256k1_context_create(SECP256K1_CONTEXT_SIGN);
+
+    for (i = 0; i < 64; i++) {
+        secp256k1_pubkey pubkey;
+        for (j = 0; j < 32; j++) {
+            seckey[j] = i + j + 1;
+        }
+        CHECK(secp256k1_ec_pubkey_create(data->ctx, &pubkey, seckey));
+        data->pubkeylens[i] = 33;
+        CHECK(secp256k1_ec_pubkey_serialize(data->ctx, &data->pubkeys[i * 33], &data->pubkeylens[i], &pubkey, SECP256K1_EC_COMPRESSED));
+    }
+}
+
+void bench_pubkey_teardown(void* arg) {
+    bench_inv_t *data = (bench_inv_t*)arg;
+    secp256k1_context_destroy(data->ctx);
+}
+
+void bench_pubkey_parse(void* arg) {
+    int i, j;
+    bench_inv_t *data = (bench_inv_t*)arg;
+    secp256k1_pubkey pubkeys[64];
+
+    for (i = 0; i < 300; i++) {
+        for (j = 0; j < 64; j++) {
+            CHECK(secp256k1_ec_pubkey_parse(data->ctx, &pubkeys[j], &data->pubkeys[j * 33], 33));
+        }
+    }
+}
+
+void bench_pubkey_parse_batch(void* arg) {
+    int i;
+    bench_inv_t *data = (bench_inv_t*)arg;
+    secp256k1_pubkey pubkeys[64];
+    unsigned char valid[8];
+
+    for (i = 0; i < 300; i++) {
+        CHECK(secp256k1_ec_pubkey_parse_batch(data->ctx, pubkeys, valid, data->pubkeys, data->pubkeylens, 64));
+    }
+}
+
+void bench_blind_setup(void* arg) {
+    bench_inv_t *data = (bench_inv_t*)arg;
+
+    bench_setup(arg);
+    data->ctx = secp256k1_context_create(SECP256K1_CONTEXT_SIGN);
+    CHECK(secp256k1_context_randomize(data->ctx, data->data));
+}
+
+void bench_blind_teardown(void* arg) {
+    bench_inv_t *data = (bench_inv_t*)arg;
+    secp256k1_context_destroy(data->ctx);
+}
+
+void bench_context_randomize(void* arg) {
+    int i;
+    bench_inv_t *data = (bench_inv_t*)arg;
+
+    for (i = 0; i < 2000; i++) {
+        CHECK(secp256k1_context_randomize(data->ctx, data->data));
+        data->data[i & 31] ^= 1;
+    }
+}
+
+void bench_context_rerandomize_step(void* arg) {
+    int i;
+    bench_inv_t *data = (bench_inv_t*)arg;
+
+    /* Measure the calls that draw a new step. */
+    for (i = 0; i < 2000; i++) {
+        data->ctx->ecmult_gen_ctx.nsteps = 0;
+        data->ctx->ecmult_gen_ctx.reblinds = SECP256K1_ECMULT_GEN_REBLIND_INTERVAL;
+        CHECK(secp256k1_context_rerandomize(data->ctx, data->data));
+        data->data[i & 31] ^= 1;
+    }
+}
+
+void bench_context_rerandomize_cheap(void* arg) {
+    int i;
+    bench_inv_t *data = (bench_inv_t*)arg;
+
+    /* Measure the calls that only use the existing steps. */
+    for (i = 0; i < SECP256K1_ECMULT_GEN_REBLIND_STEPS; i++) {
+        CHECK(secp256k1_context_rerandomize(data->ctx, data->data));
+    }
+    for (i = 0; i < 20000; i++) {
+        data->ctx->ecmult_gen_ctx.reblinds = SECP256K1_ECMULT_GEN_REBLIND_INTERVAL;
+        CHECK(secp256k1_context_rerandomize(data->ctx, data->data));
+        data->data[i & 31] ^= 1;
+    }
+}
+
 void bench_context_verify(void* arg) {
     int i;
     (void)arg;
@@ -334,6 +453,7 @@ int main(int argc, char **argv) {
     if (have_flag(argc, argv, "field") || have_flag(argc, argv, "inverse")) run_benchmark("field_inverse", bench_field_inverse, bench_setup, NULL, &data, 10, 20000);
     if (have_flag(argc, argv, "field") || have_flag(argc, argv, "inverse")) run_benchmark("field_inverse_var", bench_field_inverse_var, bench_setup, NULL, &data, 10, 20000);
     if (have_flag(argc, argv, "field") || have_flag(argc, argv, "sqrt")) run_benchmark("field_sqrt_var", bench_field_sqrt_var, bench_setup, NULL, &data, 10, 20000);
+    if (have_flag(argc, argv, "field") || have_flag(argc, argv, "sqrt")) run_benchmark("field_sqrt_4_var", bench_field_sqrt_4_var, bench_setup, NULL, &data, 10, 20000);
 
     if (have_flag(argc, argv, "group") || have_flag(argc, argv, "double")) run_benchmark("group_double_var", bench_group_double_var, bench_setup, NULL, &data, 10, 200000);
     if (have_flag(argc, argv, "group") || have_flag(argc, argv, "add")) run_benchmark("group_add_var", bench_group_add_var, bench_setup, NULL, &data, 10, 200000);
@@ -347,6 +467,12 @@ int main(int argc, char **argv) {
     if (have_flag(argc, argv, "hash") || have_flag(argc, argv, "hmac")) run_benchmark("hash_hmac_sha256", bench_hmac_sha256, bench_setup, NULL, &data, 10, 20000);
     if (have_flag(argc, argv, "hash") || have_flag(argc, argv, "rng6979")) run_benchmark("hash_rfc6979_hmac_sha256", bench_rfc6979_hmac_sha256, bench_setup, NULL, &data, 10, 20000);
 
+    if (have_flag(argc, argv, "pubkey") || have_flag(argc, argv, "parse")) run_benchmark("pubkey_parse", bench_pubkey_parse, bench_pubkey_setup, bench_pubkey_teardown, &data, 10, 300 * 64);
+    if (have_flag(argc, argv, "pubkey") || have_flag(argc, argv, "parse")) run_benchmark("pubkey_parse_batch", bench_pubkey_parse_batch, bench_pubkey_setup, bench_pubkey_teardown, &data, 10, 300 * 64);
+
+    if (have_flag(argc, argv, "context") || have_flag(argc, argv, "randomize")) run_benchmark("context_randomize", bench_context_randomize, bench_blind_setup, bench_blind_teardown, &data, 10, 2000);
+    if (have_flag(argc, argv, "context") || have_flag(argc, argv, "randomize")) run_benchmark("context_rerandomize_step", bench_context_rerandomize_step, bench_blind_setup, bench_blind_teardown, &data, 10, 2000);
+    if (have_flag(argc, argv, "context") || have_flag(argc, argv, "randomize")) run_benchmark("context_rerandomize_cheap", bench_context_rerandomize_cheap, bench_blind_setup, bench_blind_teardown, &data, 10, 20000);
     if (have_flag(argc, argv, "context") || have_flag(argc, argv, "verify")) run_benchmark("context_verify", bench_context_verify, bench_setup, NULL, &data, 10, 20);
     if (have_flag(argc, argv, "context") || have_flag(argc, argv, "sign")) run_benchmark("context_sign", bench_context_sign, bench_setup, NULL, &data, 10, 200);
 
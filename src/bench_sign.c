@@ -44,12 +44,44 @@ static void bench_sign(void* arg) {
     }
 }
 
+static void bench_sign_randomize(void* arg) {
+    int i;
+    bench_sign_t *data = (bench_sign_t*)arg;
+
+    for (i = 0; i < 2000; i++) {
+        int j;
+        secp256k1_ecdsa_signature signature;
+        CHECK(secp256k1_context_randomize(data->ctx, data->msg));
+        CHECK(secp256k1_ecdsa_sign(data->ctx, &signature, data->msg, data->key, NULL, NULL));
+        for (j = 0; j < 32; j++) {
+            data->msg[j] = signature.data[j];
+        }
+    }
+}
+
+static void bench_sign_rerandomize(void* arg) {
+    int i;
+    bench_sign_t *data = (bench_sign_t*)arg;
+
+    for (i = 0; i < 2000; i++) {
+        int j;
+        secp256k1_ecdsa_signature signature;
+        CHECK(secp256k1_context_rerandomize(data->ctx, data->msg));
+        CHECK(secp256k1_ecdsa_sign(data->ctx, &signature, data->msg, data->key, NULL, NULL));
+        for (j = 0; j < 32; j++) {
+            data->msg[j] = signature.data[j];
+        }
+    }
+}
+
 int main(void) {
     bench_sign_t data;
 
     data.ctx = secp256k1_context_create(SECP256K1_CONTEXT_SIGN);
 
     run_benchmark("ecdsa_sign", bench_sign, bench_sign_setup, NULL, &data, 10, 20000);
+    run_benchmark("ecdsa_sign_randomize", bench_sign_randomize, bench_sign_setup, NULL, &data, 10, 2000);
+    run_benchmark("ecdsa_sign_rerandomize", bench_sign_rerandomize, bench_sign_setup, NULL, &data, 10, 2000);
 
     secp256k1_context_destroy(data.ctx);
     return 0;
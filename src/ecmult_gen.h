@@ -10,6 +10,12 @@
 #include "scalar.h"
 #include "group.h"
 
+/** Number of cheap secp256k1_ecmult_gen_reblind updates between two full reblindings. */
+#define SECP256K1_ECMULT_GEN_REBLIND_INTERVAL 64
+
+/** Number of secret blinding steps; a cheap update adds a subset of them chosen by 8 hash bits. */
+#define SECP256K1_ECMULT_GEN_REBLIND_STEPS 8
+
 typedef struct {
     /* For accelerating the computation of a*G:
      * To harden against timing attacks, use the following mechanism:
@@ -26,6 +32,16 @@ typedef struct {
     secp256k1_ge_storage (*prec)[64][16]; /* prec[j][i] = 16^j * i * G + U_i */
     secp256k1_scalar blind;
     secp256k1_gej initial;
+    /* For cheaply updating blind/initial (see secp256k1_ecmult_gen_reblind):
+     * step[k] = -t_k and step_point[k] = t_k * G for independent secret scalars
+     * t_k, of which the first nsteps have been drawn since the last full
+     * reblinding. reblinds is the number of cheap updates left before the next
+     * full reblinding.
+     */
+    secp256k1_scalar step[SECP256K1_ECMULT_GEN_REBLIND_STEPS];
+    secp256k1_ge_storage step_point[SECP256K1_ECMULT_GEN_REBLIND_STEPS];
+    unsigned int nsteps;
+    unsigned int reblinds;
 } secp256k1_ecmult_gen_context;
 
 static void secp256k1_ecmult_gen_context_init(secp256k1_ecmult_gen_context* ctx);
@@ -40,4 +56,11 @@ static void secp256k1_ecmult_gen(const secp256k1_ecmult_gen_context* ctx, secp25
 
 static void secp256k1_ecmult_gen_blind(secp256k1_ecmult_gen_context *ctx, const unsigned char *seed32);
 
+/** Update the blinding values using seed32 (which cannot be NULL). The first
+ *  SECP256K1_ECMULT_GEN_REBLIND_STEPS calls after a full reblinding each cost about
+ *  one secp256k1_ecmult_gen, the following ones a hash and about ten point additions.
+ *  Once SECP256K1_ECMULT_GEN_REBLIND_INTERVAL cheap updates have been done, the next
+ *  call performs a full secp256k1_ecmult_gen_blind instead. */
+static void secp256k1_ecmult_gen_reblind(secp256k1_ecmult_gen_context *ctx, const unsigned char *seed32);
+
 #endif
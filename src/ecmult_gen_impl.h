@@ -104,6 +104,10 @@ static void secp256k1_ecmult_gen_context_clone(secp256k1_ecmult_gen_context *dst
 #endif
         dst->initial = src->initial;
         dst->blind = src->blind;
+        memcpy(dst->step, src->step, sizeof(dst->step));
+        memcpy(dst->step_point, src->step_point, sizeof(dst->step_point));
+        dst->nsteps = src->nsteps;
+        dst->reblinds = src->reblinds;
     }
 }
 
@@ -113,6 +117,10 @@ static void secp256k1_ecmult_gen_context_clear(secp256k1_ecmult_gen_context *ctx
 #endif
     secp256k1_scalar_clear(&ctx->blind);
     secp256k1_gej_clear(&ctx->initial);
+    memset(ctx->step, 0, sizeof(ctx->step));
+    memset(ctx->step_point, 0, sizeof(ctx->step_point));
+    ctx->nsteps = 0;
+    ctx->reblinds = 0;
     ctx->prec = NULL;
 }
 
@@ -198,8 +206,123 @@ static void secp256k1_ecmult_gen_blind(secp256k1_ecmult_gen_context *ctx, const
     secp256k1_scalar_negate(&b, &b);
     ctx->blind = b;
     ctx->initial = gb;
+    /* Start a new window of cheap updates, with new steps. */
+    ctx->nsteps = 0;
+    ctx->reblinds = SECP256K1_ECMULT_GEN_REBLIND_INTERVAL;
     secp256k1_scalar_clear(&b);
     secp256k1_gej_clear(&gb);
 }
 
+/* Cheaply update the blinding values for secp256k1_ecmult_gen.
+ *
+ * Let initial = b*G and blind = -b. Each cheap update hashes the old blinding value
+ * together with the new seed, and then:
+ * * While fewer than SECP256K1_ECMULT_GEN_REBLIND_STEPS steps exist, draws a new
+ *   secret step t_k from a CSPRNG keyed with the old blinding value and the seed,
+ *   computes t_k*G (one secp256k1_ecmult_gen and one inversion), and sets
+ *   b = b + t_k.
+ * * Sets b = 2*b + sum(t_k for k in S), where S is the subset of the existing steps
+ *   selected by the 8 bits of the first hash byte.
+ * * Rescales the projection of initial by a factor taken from the other hash bits.
+ * The point operations are constant time: each step is added into a temporary and
+ * kept with a conditional move, and its scalar is multiplied by 0 or 1.
+ *
+ * Security: each of the first SECP256K1_ECMULT_GEN_REBLIND_STEPS updates after a full
+ * reblinding adds a fresh 256-bit secret to b, as a full reblinding does. Every later
+ * update adds 8 bits taken from the seed, and doubles b, so after m such updates
+ * b = 2^m*b_0 + sum(c_k*t_k) with coefficients c_k below 2^m that depend on all
+ * seeds in between. An attacker who does not know the seeds must guess 8 bits per
+ * update to relate two blinding values; one who does know them learns from two
+ * consecutive blinding values b and b' the subset sum b' - 2*b. Learning enough such
+ * subset sums and one blinding value reveals every blinding value up to the next full
+ * reblinding. Each full reblinding (every SECP256K1_ECMULT_GEN_REBLIND_INTERVAL
+ * cheap updates) discards all steps and runs the seed through the RFC6979 CSPRNG.
+ */
+static void secp256k1_ecmult_gen_reblind(secp256k1_ecmult_gen_context *ctx, const unsigned char *seed32) {
+    static const secp256k1_fe fe_1 = SECP256K1_FE_CONST(0, 0, 0, 0, 0, 0, 0, 1);
+    secp256k1_sha256_t sha;
+    unsigned char buf[32];
+    secp256k1_scalar t;
+    secp256k1_scalar c;
+    secp256k1_fe s;
+    secp256k1_gej sum;
+    secp256k1_ge add;
+    unsigned int choice;
+    unsigned int k;
+    int bit;
+    VERIFY_CHECK(seed32 != NULL);
+
+    if (ctx->reblinds == 0) {
+        secp256k1_ecmult_gen_blind(ctx, seed32);
+        return;
+    }
+
+    if (ctx->nsteps < SECP256K1_ECMULT_GEN_REBLIND_STEPS) {
+        secp256k1_rfc6979_hmac_sha256_t rng;
+        unsigned char keydata[64];
+        int retry;
+
+        /* Draw a new step from a CSPRNG keyed with the blinding value and the seed. */
+        secp256k1_scalar_get_b32(keydata, &ctx->blind);
+        memcpy(keydata + 32, seed32, 32);
+        secp256k1_rfc6979_hmac_sha256_initialize(&rng, keydata, 64);
+        memset(keydata, 0, sizeof(keydata));
+        do {
+            secp256k1_rfc6979_hmac_sha256_generate(&rng, buf, 32);
+            secp256k1_scalar_set_b32(&t, buf, &retry);
+            retry |= secp256k1_scalar_is_zero(&t);
+        } while (retry);
+        secp256k1_rfc6979_hmac_sha256_finalize(&rng);
+        secp256k1_ecmult_gen(ctx, &sum, &t);
+        secp256k1_ge_set_gej(&add, &sum);
+        secp256k1_ge_to_storage(&ctx->step_point[ctx->nsteps], &add);
+        secp256k1_scalar_negate(&ctx->step[ctx->nsteps], &t);
+        ctx->nsteps++;
+        /* b += t */
+        secp256k1_gej_add_ge(&ctx->initial, &ctx->initial, &add);
+        secp256k1_scalar_negate(&t, &t);
+        secp256k1_scalar_add(&ctx->blind, &ctx->blind, &t);
+    }
+
+    /* The prior blinding value is chained forward by including it in the hash. */
+    secp256k1_scalar_get_b32(buf, &ctx->blind);
+    secp256k1_sha256_initialize(&sha);
+    secp256k1_sha256_write(&sha, buf, 32);
+    secp256k1_sha256_write(&sha, seed32, 32);
+    secp256k1_sha256_finalize(&sha, buf);
+    /* The first byte selects the steps; the rest is the rescaling factor, which is
+     * then always below the field size. */
+    choice = buf[0];
+    buf[0] = 0;
+    secp256k1_fe_set_b32(&s, buf);
+    secp256k1_fe_cmov(&s, &fe_1, secp256k1_fe_is_zero(&s));
+
+    /* b = 2*b + sum(t_k for the selected k) */
+    secp256k1_gej_double_nonzero(&ctx->initial, &ctx->initial, NULL);
+    secp256k1_scalar_add(&ctx->blind, &ctx->blind, &ctx->blind);
+    for (k = 0; k < ctx->nsteps; k++) {
+        bit = (choice >> k) & 1;
+        secp256k1_ge_from_storage(&add, &ctx->step_point[k]);
+        secp256k1_gej_add_ge(&sum, &ctx->initial, &add);
+        secp256k1_fe_cmov(&ctx->initial.x, &sum.x, bit);
+        secp256k1_fe_cmov(&ctx->initial.y, &sum.y, bit);
+        secp256k1_fe_cmov(&ctx->initial.z, &sum.z, bit);
+        ctx->initial.infinity ^= (ctx->initial.infinity ^ sum.infinity) & bit;
+        secp256k1_scalar_set_int(&c, bit);
+        secp256k1_scalar_mul(&t, &ctx->step[k], &c);
+        secp256k1_scalar_add(&ctx->blind, &ctx->blind, &t);
+    }
+    /* Randomize the projection to defend against multiplier sidechannels. */
+    secp256k1_gej_rescale(&ctx->initial, &s);
+    ctx->reblinds--;
+
+    memset(buf, 0, sizeof(buf));
+    secp256k1_fe_clear(&s);
+    secp256k1_scalar_clear(&t);
+    secp256k1_scalar_clear(&c);
+    secp256k1_gej_clear(&sum);
+    secp256k1_ge_clear(&add);
+    choice = 0;
+}
+
 #endif
@@ -92,6 +92,11 @@ static void secp256k1_fe_sqr(secp256k1_fe *r, const secp256k1_fe *a);
  *  normalized). Return value indicates whether a square root was found. */
 static int secp256k1_fe_sqrt_var(secp256k1_fe *r, const secp256k1_fe *a);
 
+/** Compute square roots of 4 field elements at once, as secp256k1_fe_sqrt_var does for
+ *  one. Returns a bitmask in which bit i is set if a[i] has a square root. r must not
+ *  overlap a. */
+static int secp256k1_fe_sqrt_4_var(secp256k1_fe *r, const secp256k1_fe *a);
+
 /** Sets a field element to be the (modular) inverse of another. Requires the input's magnitude to be
  *  at most 8. The output magnitude is 1 (but not guaranteed to be normalized). */
 static void secp256k1_fe_inv(secp256k1_fe *r, const secp256k1_fe *a);
@@ -117,6 +117,85 @@ static int secp256k1_fe_sqrt_var(secp256k1_fe *r, const secp256k1_fe *a) {
     return secp256k1_fe_equal_var(&t1, a);
 }
 
+/* Square each of the 4 elements of a rep times into r, one round of all 4 at a time. */
+static void secp256k1_fe_sqr_4(secp256k1_fe *r, const secp256k1_fe *a, int rep) {
+    int i, j;
+    for (i = 0; i < 4; i++) {
+        r[i] = a[i];
+    }
+    for (j = 0; j < rep; j++) {
+        for (i = 0; i < 4; i++) {
+            secp256k1_fe_sqr(&r[i], &r[i]);
+        }
+    }
+}
+
+static void secp256k1_fe_mul_4(secp256k1_fe *r, const secp256k1_fe *a) {
+    int i;
+    for (i = 0; i < 4; i++) {
+        secp256k1_fe_mul(&r[i], &r[i], &a[i]);
+    }
+}
+
+static int secp256k1_fe_sqrt_4_var(secp256k1_fe *r, const secp256k1_fe *a) {
+    secp256k1_fe x2[4], x3[4], x6[4], x9[4], x11[4], x22[4], x44[4], x88[4], x176[4], x220[4], x223[4], t1[4];
+    int i;
+    int ret = 0;
+
+    /** Same addition chain as secp256k1_fe_sqrt_var, but running 4 independent
+     *  chains side by side. Each step only depends on the previous step of the
+     *  same chain, so the CPU can overlap the field operations of the 4 chains
+     *  instead of waiting for each result in turn.
+     */
+
+    secp256k1_fe_sqr_4(x2, a, 1);
+    secp256k1_fe_mul_4(x2, a);
+
+    secp256k1_fe_sqr_4(x3, x2, 1);
+    secp256k1_fe_mul_4(x3, a);
+
+    secp256k1_fe_sqr_4(x6, x3, 3);
+    secp256k1_fe_mul_4(x6, x3);
+
+    secp256k1_fe_sqr_4(x9, x6, 3);
+    secp256k1_fe_mul_4(x9, x3);
+
+    secp256k1_fe_sqr_4(x11, x9, 2);
+    secp256k1_fe_mul_4(x11, x2);
+
+    secp256k1_fe_sqr_4(x22, x11, 11);
+    secp256k1_fe_mul_4(x22, x11);
+
+    secp256k1_fe_sqr_4(x44, x22, 22);
+    secp256k1_fe_mul_4(x44, x22);
+
+    secp256k1_fe_sqr_4(x88, x44, 44);
+    secp256k1_fe_mul_4(x88, x44);
+
+    secp256k1_fe_sqr_4(x176, x88, 88);
+    secp256k1_fe_mul_4(x176, x88);
+
+    secp256k1_fe_sqr_4(x220, x176, 44);
+    secp256k1_fe_mul_4(x220, x44);
+
+    secp256k1_fe_sqr_4(x223, x220, 3);
+    secp256k1_fe_mul_4(x223, x3);
+
+    secp256k1_fe_sqr_4(t1, x223, 23);
+    secp256k1_fe_mul_4(t1, x22);
+    secp256k1_fe_sqr_4(t1, t1, 6);
+    secp256k1_fe_mul_4(t1, x2);
+    secp256k1_fe_sqr_4(r, t1, 2);
+
+    /* Check that square roots were actually calculated */
+
+    secp256k1_fe_sqr_4(t1, r, 1);
+    for (i = 0; i < 4; i++) {
+        ret |= secp256k1_fe_equal_var(&t1[i], &a[i]) << i;
+    }
+    return ret;
+}
+
 static void secp256k1_fe_inv(secp256k1_fe *r, const secp256k1_fe *a) {
     secp256k1_fe x2, x3, x6, x9, x11, x22, x44, x88, x176, x220, x223, t1;
     int j;
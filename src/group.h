@@ -47,6 +47,10 @@ static void secp256k1_ge_set_xy(secp256k1_ge *r, const secp256k1_fe *x, const se
  *  for Y. Return value indicates whether the result is valid. */
 static int secp256k1_ge_set_xo_var(secp256k1_ge *r, const secp256k1_fe *x, int odd);
 
+/** Do secp256k1_ge_set_xo_var for 4 X coordinates at once. Returns a bitmask in which bit i
+ *  indicates whether r[i] is valid. */
+static int secp256k1_ge_set_xo_4_var(secp256k1_ge *r, const secp256k1_fe *x, const int *odd);
+
 /** Check whether a group element is the point at infinity. */
 static int secp256k1_ge_is_infinity(const secp256k1_ge *a);
 
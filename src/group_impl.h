@@ -183,6 +183,29 @@ static int secp256k1_ge_set_xo_var(secp256k1_ge *r, const secp256k1_fe *x, int o
     return 1;
 }
 
+static int secp256k1_ge_set_xo_4_var(secp256k1_ge *r, const secp256k1_fe *x, const int *odd) {
+    secp256k1_fe x2, c[4], y[4];
+    int i;
+    int ret;
+    for (i = 0; i < 4; i++) {
+        r[i].x = x[i];
+        r[i].infinity = 0;
+        secp256k1_fe_sqr(&x2, &x[i]);
+        secp256k1_fe_mul(&c[i], &x[i], &x2);
+        secp256k1_fe_set_int(&x2, 7);
+        secp256k1_fe_add(&c[i], &x2);
+    }
+    ret = secp256k1_fe_sqrt_4_var(y, c);
+    for (i = 0; i < 4; i++) {
+        r[i].y = y[i];
+        secp256k1_fe_normalize_var(&r[i].y);
+        if (secp256k1_fe_is_odd(&r[i].y) != odd[i]) {
+            secp256k1_fe_negate(&r[i].y, &r[i].y, 1);
+        }
+    }
+    return ret;
+}
+
 static void secp256k1_gej_set_ge(secp256k1_gej *r, const secp256k1_ge *a) {
    r->infinity = a->infinity;
    r->x = a->x;
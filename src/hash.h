@@ -11,7 +11,7 @@
 #include <stdint.h>
 
 typedef struct {
-    uint32_t s[32];
+    uint32_t s[8];
     uint32_t buf[16]; /* In big endian */
     size_t bytes;
 } secp256k1_sha256_t;
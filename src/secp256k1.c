@@ -158,6 +158,63 @@ int secp256k1_ec_pubkey_parse(const secp256k1_context* ctx, secp256k1_pubkey* pu
     return 1;
 }
 
+int secp256k1_ec_pubkey_parse_batch(const secp256k1_context* ctx, secp256k1_pubkey *pubkeys, unsigned char *valid, const unsigned char *input, const size_t *inputlens, size_t n) {
+    secp256k1_ge Q[4];
+    secp256k1_fe x[4];
+    int odd[4];
+    size_t idx[4];
+    size_t i;
+    size_t parsed = 0;
+    int lanes = 0;
+    int mask;
+    int k;
+
+    (void)ctx;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(pubkeys != NULL);
+    memset(pubkeys, 0, n * sizeof(*pubkeys));
+    ARG_CHECK(valid != NULL);
+    memset(valid, 0, (n + 7) / 8);
+    ARG_CHECK(input != NULL);
+    ARG_CHECK(inputlens != NULL);
+    for (i = 0; i < n; i++) {
+        const unsigned char *pub = input;
+        input += inputlens[i];
+        if (inputlens[i] == 33 && (pub[0] == 0x02 || pub[0] == 0x03)) {
+            /* Queue compressed keys, so their square roots are computed 4 at a time. */
+            if (secp256k1_fe_set_b32(&x[lanes], pub + 1)) {
+                odd[lanes] = pub[0] == 0x03;
+                idx[lanes] = i;
+                lanes++;
+            }
+            if (lanes == 4) {
+                mask = secp256k1_ge_set_xo_4_var(Q, x, odd);
+                for (k = 0; k < 4; k++) {
+                    if ((mask >> k) & 1) {
+                        secp256k1_pubkey_save(&pubkeys[idx[k]], &Q[k]);
+                        valid[idx[k] / 8] |= 1 << (idx[k] % 8);
+                        parsed++;
+                    }
+                }
+                lanes = 0;
+            }
+        } else if (secp256k1_eckey_pubkey_parse(&Q[0], pub, inputlens[i])) {
+            secp256k1_pubkey_save(&pubkeys[i], &Q[0]);
+            valid[i / 8] |= 1 << (i % 8);
+            parsed++;
+        }
+    }
+    /* Finish the remaining compressed keys one by one. */
+    for (k = 0; k < lanes; k++) {
+        if (secp256k1_ge_set_xo_var(&Q[0], &x[k], odd[k])) {
+            secp256k1_pubkey_save(&pubkeys[idx[k]], &Q[0]);
+            valid[idx[k] / 8] |= 1 << (idx[k] % 8);
+            parsed++;
+        }
+    }
+    return parsed == n;
+}
+
 int secp256k1_ec_pubkey_serialize(const secp256k1_context* ctx, unsigned char *output, size_t *outputlen, const secp256k1_pubkey* pubkey, unsigned int flags) {
     secp256k1_ge Q;
 
@@ -238,6 +295,74 @@ int secp256k1_ecdsa_verify(const secp256k1_context* ctx, const secp256k1_ecdsa_s
             secp256k1_ecdsa_sig_verify(&ctx->ecmult_ctx, &r, &s, &q, &m));
 }
 
+/* secp256k1_sha256_t is at most 104 bytes, so it always fits inside secp256k1_hashstate.
+ * This fails to compile (negative array size) if that ever stops being true. */
+typedef char secp256k1_hashstate_size_check[sizeof(secp256k1_sha256_t) <= sizeof(secp256k1_hashstate) ? 1 : -1];
+
+static void secp256k1_hashstate_load(secp256k1_sha256_t* hash, const secp256k1_hashstate* hashstate) {
+    /* Note that secp256k1_hashstate_save must use the same representation. */
+    memcpy(hash, &hashstate->data[0], sizeof(*hash));
+}
+
+static void secp256k1_hashstate_save(secp256k1_hashstate* hashstate, const secp256k1_sha256_t* hash) {
+    memset(hashstate, 0, sizeof(*hashstate));
+    memcpy(&hashstate->data[0], hash, sizeof(*hash));
+}
+
+/* Finalizes a copy of hashstate, so the caller's state stays usable. */
+static void secp256k1_hashstate_get_b32(unsigned char *out32, const secp256k1_hashstate* hashstate, unsigned int flags) {
+    secp256k1_sha256_t hash;
+    secp256k1_hashstate_load(&hash, hashstate);
+    secp256k1_sha256_finalize(&hash, out32);
+    if (flags & SECP256K1_HASHSTATE_DOUBLE) {
+        secp256k1_sha256_initialize(&hash);
+        secp256k1_sha256_write(&hash, out32, 32);
+        secp256k1_sha256_finalize(&hash, out32);
+    }
+}
+
+int secp256k1_hashstate_initialize(const secp256k1_context* ctx, secp256k1_hashstate *hashstate) {
+    secp256k1_sha256_t hash;
+
+    (void)ctx;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(hashstate != NULL);
+    secp256k1_sha256_initialize(&hash);
+    secp256k1_hashstate_save(hashstate, &hash);
+    return 1;
+}
+
+int secp256k1_hashstate_write(const secp256k1_context* ctx, secp256k1_hashstate *hashstate, const unsigned char *input, size_t inputlen) {
+    secp256k1_sha256_t hash;
+
+    (void)ctx;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(hashstate != NULL);
+    ARG_CHECK(input != NULL || inputlen == 0);
+    secp256k1_hashstate_load(&hash, hashstate);
+    secp256k1_sha256_write(&hash, input, inputlen);
+    secp256k1_hashstate_save(hashstate, &hash);
+    return 1;
+}
+
+int secp256k1_hashstate_finalize(const secp256k1_context* ctx, unsigned char *output32, const secp256k1_hashstate *hashstate, unsigned int flags) {
+    (void)ctx;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(output32 != NULL);
+    ARG_CHECK(hashstate != NULL);
+    secp256k1_hashstate_get_b32(output32, hashstate, flags);
+    return 1;
+}
+
+int secp256k1_ecdsa_verify_hashstate(const secp256k1_context* ctx, const secp256k1_ecdsa_signature *sig, const secp256k1_hashstate *hashstate, const secp256k1_pubkey *pubkey, unsigned int flags) {
+    unsigned char msg32[32];
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(hashstate != NULL);
+
+    secp256k1_hashstate_get_b32(msg32, hashstate, flags);
+    return secp256k1_ecdsa_verify(ctx, sig, msg32, pubkey);
+}
+
 static int nonce_function_rfc6979(unsigned char *nonce32, const unsigned char *msg32, const unsigned char *key32, const unsigned char *algo16, void *data, unsigned int counter) {
    unsigned char keydata[112];
    int keylen = 64;
@@ -318,6 +443,15 @@ int secp256k1_ecdsa_sign(const secp256k1_context* ctx, secp256k1_ecdsa_signature
     return ret;
 }
 
+int secp256k1_ecdsa_sign_hashstate(const secp256k1_context* ctx, secp256k1_ecdsa_signature *signature, const secp256k1_hashstate *hashstate, const unsigned char *seckey, secp256k1_nonce_function noncefp, const void* noncedata, unsigned int flags) {
+    unsigned char msg32[32];
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(hashstate != NULL);
+
+    secp256k1_hashstate_get_b32(msg32, hashstate, flags);
+    return secp256k1_ecdsa_sign(ctx, signature, msg32, seckey, noncefp, noncedata);
+}
+
 int secp256k1_ec_seckey_verify(const secp256k1_context* ctx, const unsigned char *seckey) {
     secp256k1_scalar sec;
     int ret;
@@ -483,6 +617,14 @@ int secp256k1_context_randomize(secp256k1_context* ctx, const unsigned char *see
     return 1;
 }
 
+int secp256k1_context_rerandomize(secp256k1_context* ctx, const unsigned char *seed32) {
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    ARG_CHECK(seed32 != NULL);
+    secp256k1_ecmult_gen_reblind(&ctx->ecmult_gen_ctx, seed32);
+    return 1;
+}
+
 int secp256k1_ec_pubkey_combine(const secp256k1_context* ctx, secp256k1_pubkey *pubnonce, const secp256k1_pubkey * const *pubnonces, int n) {
     int i;
     secp256k1_gej Qj;
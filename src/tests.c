@@ -199,6 +199,54 @@ void run_sha256_tests(void) {
     }
 }
 
+void run_hashstate_tests(void) {
+    static const unsigned char abc_double[32] = {
+        0x4f, 0x8b, 0x42, 0xc2, 0x2d, 0xd3, 0x72, 0x9b, 0x51, 0x9b, 0xa6, 0xf6, 0x8d, 0x2d, 0xa7, 0xcc,
+        0x5b, 0x2d, 0x60, 0x6d, 0x05, 0xda, 0xed, 0x5a, 0xd5, 0x12, 0x8c, 0xc0, 0x3e, 0x6c, 0x63, 0x58
+    };
+    unsigned char out[32];
+    unsigned char out2[32];
+    unsigned char data[200];
+    secp256k1_hashstate state;
+    secp256k1_hashstate state2;
+    secp256k1_sha256_t hasher;
+    int i;
+
+    CHECK(secp256k1_hashstate_initialize(ctx, &state) == 1);
+    CHECK(secp256k1_hashstate_write(ctx, &state, NULL, 0) == 1);
+    CHECK(secp256k1_hashstate_write(ctx, &state, (const unsigned char*)"abc", 3) == 1);
+    CHECK(secp256k1_hashstate_finalize(ctx, out, &state, SECP256K1_HASHSTATE_DOUBLE) == 1);
+    CHECK(memcmp(out, abc_double, 32) == 0);
+
+    for (i = 0; i < count; i++) {
+        size_t len = secp256k1_rand32() % sizeof(data);
+        size_t split = secp256k1_rand32() % (len + 1);
+        size_t j;
+        for (j = 0; j < len; j++) {
+            data[j] = secp256k1_rand32();
+        }
+        secp256k1_sha256_initialize(&hasher);
+        secp256k1_sha256_write(&hasher, data, len);
+        secp256k1_sha256_finalize(&hasher, out);
+        CHECK(secp256k1_hashstate_initialize(ctx, &state));
+        CHECK(secp256k1_hashstate_write(ctx, &state, data, split));
+        /* A copied state continues independently of the original. */
+        state2 = state;
+        CHECK(secp256k1_hashstate_write(ctx, &state, data + split, len - split));
+        CHECK(secp256k1_hashstate_finalize(ctx, out2, &state, 0));
+        CHECK(memcmp(out, out2, 32) == 0);
+        /* Finalizing does not modify the state. */
+        CHECK(secp256k1_hashstate_finalize(ctx, out2, &state, 0));
+        CHECK(memcmp(out, out2, 32) == 0);
+        CHECK(secp256k1_hashstate_write(ctx, &state2, data + split, len - split));
+        CHECK(secp256k1_hashstate_finalize(ctx, out2, &state2, SECP256K1_HASHSTATE_DOUBLE));
+        secp256k1_sha256_initialize(&hasher);
+        secp256k1_sha256_write(&hasher, out, 32);
+        secp256k1_sha256_finalize(&hasher, out);
+        CHECK(memcmp(out, out2, 32) == 0);
+    }
+}
+
 void run_hmac_sha256_tests(void) {
     static const char *keys[6] = {
         "\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b",
@@ -953,6 +1001,48 @@ void run_sqrt(void) {
     }
 }
 
+void test_sqrt_4(const secp256k1_fe *a) {
+    /* Every lane must agree with secp256k1_fe_sqrt_var on its own input. */
+    secp256k1_fe r4[4], r;
+    int i;
+    int mask = secp256k1_fe_sqrt_4_var(r4, a);
+    CHECK((mask & ~15) == 0);
+    for (i = 0; i < 4; i++) {
+        int v = secp256k1_fe_sqrt_var(&r, &a[i]);
+        CHECK(((mask >> i) & 1) == v);
+        if (v) {
+            CHECK(secp256k1_fe_equal_var(&r4[i], &r));
+        }
+    }
+}
+
+void run_sqrt_4(void) {
+    secp256k1_fe a[4], x, ns;
+    int i, j;
+
+    /* Mix squares, their negations (non-squares), other non-squares, random
+     * values and zero over the lanes, in rotating order. */
+    for (i = 0; i < count * 4; i++) {
+        random_fe(&x);
+        secp256k1_fe_sqr(&a[0], &x);
+        secp256k1_fe_negate(&a[1], &a[0], 1);
+        random_fe_non_square(&ns);
+        secp256k1_fe_mul(&a[2], &a[0], &ns);
+        random_fe(&a[3]);
+        if (i % 8 == 7) {
+            secp256k1_fe_clear(&a[3]);
+        }
+        for (j = 0; j < i % 4; j++) {
+            x = a[0];
+            a[0] = a[1];
+            a[1] = a[2];
+            a[2] = a[3];
+            a[3] = x;
+        }
+        test_sqrt_4(a);
+    }
+}
+
 /***** GROUP TESTS *****/
 
 void ge_equals_ge(const secp256k1_ge *a, const secp256k1_ge *b) {
@@ -1725,12 +1815,59 @@ void test_ecmult_gen_blind_reset(void) {
     CHECK(gej_xyz_equals_gej(&initial, &ctx->ecmult_gen_ctx.initial));
 }
 
+void test_ecmult_gen_reblind(void) {
+    /* Test that cheap reblinding keeps ecmult_gen() correct, changes the blinding, and periodically does a full reblinding. */
+    secp256k1_scalar key;
+    secp256k1_scalar b;
+    unsigned char seed32[32];
+    secp256k1_gej pgej;
+    secp256k1_gej pgej2;
+    secp256k1_gej i;
+    secp256k1_ge pge;
+    unsigned int n;
+    unsigned int m;
+    random_scalar_order_test(&key);
+    secp256k1_ecmult_gen(&ctx->ecmult_gen_ctx, &pgej, &key);
+    secp256k1_ge_set_gej(&pge, &pgej);
+    /* A full blinding starts a window of cheap updates, without any steps yet. */
+    secp256k1_rand256(seed32);
+    secp256k1_ecmult_gen_blind(&ctx->ecmult_gen_ctx, seed32);
+    CHECK(ctx->ecmult_gen_ctx.reblinds == SECP256K1_ECMULT_GEN_REBLIND_INTERVAL);
+    CHECK(ctx->ecmult_gen_ctx.nsteps == 0);
+    for (n = 0; n <= 2 * SECP256K1_ECMULT_GEN_REBLIND_INTERVAL + 1; n++) {
+        secp256k1_rand256(seed32);
+        b = ctx->ecmult_gen_ctx.blind;
+        i = ctx->ecmult_gen_ctx.initial;
+        secp256k1_ecmult_gen_reblind(&ctx->ecmult_gen_ctx, seed32);
+        m = n % (SECP256K1_ECMULT_GEN_REBLIND_INTERVAL + 1);
+        if (m == SECP256K1_ECMULT_GEN_REBLIND_INTERVAL) {
+            /* Every (INTERVAL+1)th call is a full reblinding. */
+            CHECK(ctx->ecmult_gen_ctx.reblinds == SECP256K1_ECMULT_GEN_REBLIND_INTERVAL);
+            CHECK(ctx->ecmult_gen_ctx.nsteps == 0);
+        } else {
+            /* The first STEPS cheap updates each add one step. */
+            CHECK(ctx->ecmult_gen_ctx.reblinds == SECP256K1_ECMULT_GEN_REBLIND_INTERVAL - 1 - m);
+            CHECK(ctx->ecmult_gen_ctx.nsteps == (m < SECP256K1_ECMULT_GEN_REBLIND_STEPS ? m + 1 : SECP256K1_ECMULT_GEN_REBLIND_STEPS));
+        }
+        CHECK(!secp256k1_scalar_eq(&b, &ctx->ecmult_gen_ctx.blind));
+        CHECK(!gej_xyz_equals_gej(&i, &ctx->ecmult_gen_ctx.initial));
+        secp256k1_ecmult_gen(&ctx->ecmult_gen_ctx, &pgej2, &key);
+        CHECK(!gej_xyz_equals_gej(&pgej, &pgej2));
+        ge_equals_gej(&pge, &pgej2);
+    }
+}
+
 void run_ecmult_gen_blind(void) {
     int i;
+    unsigned char seed32[32] = {0};
     test_ecmult_gen_blind_reset();
     for (i = 0; i < 10; i++) {
         test_ecmult_gen_blind();
     }
+    test_ecmult_gen_reblind();
+    /* Check the public API, and leave the context with a full blinding again. */
+    CHECK(secp256k1_context_rerandomize(ctx, seed32) == 1);
+    CHECK(secp256k1_context_randomize(ctx, seed32) == 1);
 }
 
 #ifdef USE_ENDOMORPHISM
@@ -2192,6 +2329,46 @@ void run_ecdsa_sign_verify(void) {
     }
 }
 
+void test_ecdsa_sign_verify_hashstate(void) {
+    unsigned char privkey[32];
+    unsigned char message[64];
+    unsigned char msg32[32];
+    unsigned int flags = secp256k1_rand32() & SECP256K1_HASHSTATE_DOUBLE;
+    size_t split = secp256k1_rand32() % (sizeof(message) + 1);
+    secp256k1_scalar key;
+    secp256k1_hashstate state;
+    secp256k1_pubkey pubkey;
+    secp256k1_ecdsa_signature sig;
+    secp256k1_ecdsa_signature sig2;
+
+    random_scalar_order_test(&key);
+    secp256k1_scalar_get_b32(privkey, &key);
+    CHECK(secp256k1_ec_pubkey_create(ctx, &pubkey, privkey) == 1);
+    secp256k1_rand256_test(message);
+    secp256k1_rand256_test(message + 32);
+
+    CHECK(secp256k1_hashstate_initialize(ctx, &state));
+    CHECK(secp256k1_hashstate_write(ctx, &state, message, split));
+    CHECK(secp256k1_hashstate_write(ctx, &state, message + split, sizeof(message) - split));
+    CHECK(secp256k1_hashstate_finalize(ctx, msg32, &state, flags));
+
+    /* Signing the hash state is the same as signing its hash. */
+    CHECK(secp256k1_ecdsa_sign_hashstate(ctx, &sig, &state, privkey, NULL, NULL, flags) == 1);
+    CHECK(secp256k1_ecdsa_sign(ctx, &sig2, msg32, privkey, NULL, NULL) == 1);
+    CHECK(memcmp(&sig, &sig2, sizeof(sig)) == 0);
+    CHECK(secp256k1_ecdsa_verify_hashstate(ctx, &sig, &state, &pubkey, flags) == 1);
+    CHECK(secp256k1_ecdsa_verify(ctx, &sig, msg32, &pubkey) == 1);
+    /* Hashing a different number of times gives a different message. */
+    CHECK(secp256k1_ecdsa_verify_hashstate(ctx, &sig, &state, &pubkey, flags ^ SECP256K1_HASHSTATE_DOUBLE) == 0);
+}
+
+void run_ecdsa_sign_verify_hashstate(void) {
+    int i;
+    for (i = 0; i < count; i++) {
+        test_ecdsa_sign_verify_hashstate();
+    }
+}
+
 /** Dummy nonce generation function that just uses a precomputed nonce, and fails if it is not accepted. Use only for testing. */
 static int precomputed_nonce_function(unsigned char *nonce32, const unsigned char *msg32, const unsigned char *key32, const unsigned char *algo16, void *data, unsigned int counter) {
     (void)msg32;
@@ -2422,6 +2599,58 @@ void run_random_pubkeys(void) {
     }
 }
 
+void run_ec_pubkey_parse_batch_test(void) {
+    unsigned char input[16 * 65];
+    size_t inputlens[16];
+    secp256k1_pubkey pubkeys[16];
+    secp256k1_pubkey pubkey;
+    unsigned char valid[2];
+    int i, j;
+    for (i = 0; i < count; i++) {
+        size_t n = secp256k1_rand32() % 17;
+        size_t pos = 0;
+        int allvalid = 1;
+        int ret;
+        for (j = 0; j < (int)n; j++) {
+            unsigned char seckey[32];
+            secp256k1_scalar key;
+            random_scalar_order_test(&key);
+            secp256k1_scalar_get_b32(seckey, &key);
+            CHECK(secp256k1_ec_pubkey_create(ctx, &pubkey, seckey) == 1);
+            inputlens[j] = 65;
+            CHECK(secp256k1_ec_pubkey_serialize(ctx, &input[pos], &inputlens[j], &pubkey, (secp256k1_rand32() & 1) ? SECP256K1_EC_COMPRESSED : 0) == 1);
+            if ((secp256k1_rand32() & 3) == 0) {
+                /* Corrupt the X coordinate; the result may or may not be a valid key. */
+                input[pos + 1 + secp256k1_rand32() % 32] ^= 1 << (secp256k1_rand32() % 8);
+            }
+            if ((secp256k1_rand32() & 7) == 0) {
+                /* Truncate the encoding. */
+                inputlens[j] = secp256k1_rand32() % inputlens[j];
+            }
+            pos += inputlens[j];
+        }
+        memset(valid, 0xFF, sizeof(valid));
+        for (j = 0; j < (int)n; j++) {
+            memset(&pubkeys[j], 0xFF, sizeof(pubkeys[j]));
+        }
+        ret = secp256k1_ec_pubkey_parse_batch(ctx, pubkeys, valid, input, inputlens, n);
+        /* Every key matches the result of parsing it on its own. */
+        pos = 0;
+        for (j = 0; j < (int)n; j++) {
+            int res = secp256k1_ec_pubkey_parse(ctx, &pubkey, &input[pos], inputlens[j]);
+            CHECK(((valid[j / 8] >> (j % 8)) & 1) == res);
+            CHECK(memcmp(&pubkey, &pubkeys[j], sizeof(pubkey)) == 0);
+            allvalid &= res;
+            pos += inputlens[j];
+        }
+        CHECK(ret == allvalid);
+        /* Unused bits of the bitmap are cleared. */
+        for (j = n; j < (int)((n + 7) & ~7); j++) {
+            CHECK(((valid[j / 8] >> (j % 8)) & 1) == 0);
+        }
+    }
+}
+
 void run_ecdsa_end_to_end(void) {
     int i;
     for (i = 0; i < 64*count; i++) {
@@ -2687,6 +2916,7 @@ int main(int argc, char **argv) {
         CHECK(secp256k1_context_randomize(ctx, (secp256k1_rand32() & 1) ? run32 : NULL));
     }
     run_sha256_tests();
+    run_hashstate_tests();
     run_hmac_sha256_tests();
     run_rfc6979_hmac_sha256_tests();
 
@@ -2706,6 +2936,7 @@ int main(int argc, char **argv) {
     run_field_convert();
     run_sqr();
     run_sqrt();
+    run_sqrt_4();
 
     /* group tests */
     run_ge();
@@ -2726,6 +2957,7 @@ int main(int argc, char **argv) {
 
     /* EC point parser test*/
     run_ec_pubkey_parse_test();
+    run_ec_pubkey_parse_batch_test();
 
 #ifdef ENABLE_MODULE_ECDH
     /* ecdh tests */
@@ -2735,6 +2967,7 @@ int main(int argc, char **argv) {
     /* ecdsa tests */
     run_random_pubkeys();
     run_ecdsa_sign_verify();
+    run_ecdsa_sign_verify_hashstate();
     run_ecdsa_end_to_end();
     run_ecdsa_edge_cases();
 #ifdef ENABLE_OPENSSL_TESTS